@@ -3,6 +3,7 @@
 #include "Config.h"
 #include "GmCommands.h"
 #include "Log.h"
+#include "ObjectGuid.h"
 #include "Player.h"
 #include "PlayerScript.h"
 #include "ScriptMgr.h"
@@ -13,27 +14,36 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
-#include <limits>
+#include <cerrno>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
 #include <sstream>
 #include <unordered_map>
 
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 namespace
 {
     constexpr char const* ACCOUNT_IDS_KEY = "GmCommandsModule.AccountIds";
     constexpr char const* DEFAULT_COMMANDS_KEY = "GmCommandsModule.DefaultCommands";
     constexpr char const* DEFAULT_LEVEL_KEY = "GmCommandsModule.DefaultLevel";
     constexpr char const* ENABLE_KEY = "GmCommandsModule.Enable";
+    constexpr char const* LAZY_RESOLVE_KEY = "GmCommandsModule.LazyResolve";
     constexpr char const* PRESETS_KEY = "GmCommandsModule.Presets";
+    constexpr char const* WATCH_CONFIG_KEY = "GmCommandsModule.WatchConfig";
     constexpr char const* MODULE_CONFIG_FILE = "mod_gm_commands.conf";
     constexpr char const* MODULE_CONFIG_DIST_FILE = "mod_gm_commands.conf.dist";
 
-    struct FileAccountOverrides
-    {
-        std::optional<uint32> Level;
-        std::optional<std::string> Commands;
-        std::optional<std::string> Preset;
-    };
+    // How long the watcher waits for a burst of file events to settle before reloading
+    constexpr int CONFIG_WATCH_SETTLE_MS = 250;
 
     template <typename T>
     T GetOptionWithoutLog(std::string const& name, T const& def)
@@ -41,18 +51,23 @@ namespace
         return sConfigMgr->GetOption<T>(name, def, false);
     }
 
-    std::unordered_map<uint32, FileAccountOverrides> ReadAccountOverridesFromConfigFiles()
+    std::string GetModuleConfigDirectory()
     {
-        std::unordered_map<uint32, FileAccountOverrides> overrides;
+        return Acore::StringFormat("{}modules/", sConfigMgr->GetConfigPath());
+    }
 
-        std::string const basePath = Acore::StringFormat("{}modules/", sConfigMgr->GetConfigPath());
+    // Reads every GmCommandsModule.* key from the .dist file and then the .conf file,
+    // so values in the latter win. Returns false if neither file could be opened.
+    bool ReadModuleConfigFiles(std::string const& directory, std::unordered_map<std::string, std::string>& values, std::vector<std::string>& errors)
+    {
         std::array<std::string, 2> const filenames =
         {
-            basePath + MODULE_CONFIG_DIST_FILE,
-            basePath + MODULE_CONFIG_FILE
+            directory + MODULE_CONFIG_DIST_FILE,
+            directory + MODULE_CONFIG_FILE
         };
 
-        std::string const prefix = "GmCommandsModule.Account.";
+        std::string const prefix = "GmCommandsModule.";
+        bool anyRead = false;
 
         for (std::string const& file : filenames)
         {
@@ -60,16 +75,24 @@ namespace
             if (!stream.is_open())
                 continue;
 
+            anyRead = true;
+
             std::string line;
+            uint32 lineNumber = 0;
             while (std::getline(stream, line))
             {
+                ++lineNumber;
+
                 line = Acore::String::Trim(line);
                 if (line.empty() || line.front() == '#' || line.front() == '[')
                     continue;
 
                 std::size_t const equalPos = line.find('=');
                 if (equalPos == std::string::npos)
+                {
+                    errors.push_back(Acore::StringFormat("{}:{}: expected '<key> = <value>', got '{}'", file, lineNumber, line));
                     continue;
+                }
 
                 std::string key = Acore::String::Trim(line.substr(0, equalPos));
                 if (key.rfind(prefix, 0) != 0)
@@ -78,42 +101,142 @@ namespace
                 std::string value = Acore::String::Trim(line.substr(equalPos + 1));
                 value.erase(std::remove(value.begin(), value.end(), '"'), value.end());
 
-                std::string_view const suffix = std::string_view(key).substr(prefix.size());
-                std::size_t const dotPos = suffix.find('.');
-                if (dotPos == std::string::npos)
-                    continue;
+                values[std::move(key)] = std::move(value);
+            }
+        }
 
-                std::string accountString(suffix.substr(0, dotPos));
-                std::string_view const field = suffix.substr(dotPos + 1);
+        return anyRead;
+    }
 
-                std::optional<uint32> accountIdOpt = Acore::StringTo<uint32>(accountString);
-                if (!accountIdOpt)
-                    continue;
+    // Accepts either a single id ("6948") or an inclusive range ("1-100").
+    std::optional<std::pair<uint32, uint32>> ParseIdRange(std::string_view token)
+    {
+        std::size_t const dashPos = token.find('-');
+        if (dashPos == std::string_view::npos)
+        {
+            if (std::optional<uint32> id = Acore::StringTo<uint32>(token))
+                return std::make_pair(*id, *id);
 
-                FileAccountOverrides& entry = overrides[*accountIdOpt];
+            return std::nullopt;
+        }
 
-                if (field == "Level")
-                {
-                    if (std::optional<uint32> levelOpt = Acore::StringTo<uint32>(value))
-                        entry.Level = *levelOpt;
-                }
-                else if (field == "Commands")
-                {
-                    if (!value.empty())
-                        entry.Commands = value;
-                }
-                else if (field == "Preset")
-                {
-                    if (!value.empty())
-                        entry.Preset = value;
-                }
+        std::optional<uint32> first = Acore::StringTo<uint32>(Acore::String::Trim(std::string(token.substr(0, dashPos))));
+        std::optional<uint32> last = Acore::StringTo<uint32>(Acore::String::Trim(std::string(token.substr(dashPos + 1))));
+        if (!first || !last)
+            return std::nullopt;
+
+        return std::make_pair(*first, *last);
+    }
+
+    // True for tokens meant as an id or id range, so a typo like "1o0-200" or "100-"
+    // is reported instead of silently becoming a name that never matches
+    bool LooksLikeIdRange(std::string_view token)
+    {
+        if (token.empty())
+            return false;
+
+        if (std::isdigit(static_cast<unsigned char>(token.front())))
+            return true;
+
+        for (std::size_t dashPos = token.find('-'); dashPos != std::string_view::npos; dashPos = token.find('-', dashPos + 1))
+        {
+            if (dashPos > 0 && std::isdigit(static_cast<unsigned char>(token[dashPos - 1])))
+                return true;
+
+            if (dashPos + 1 < token.size() && std::isdigit(static_cast<unsigned char>(token[dashPos + 1])))
+                return true;
+        }
+
+        return false;
+    }
+
+    // Parses a comma separated list of account ids and id ranges such as "42, 1000-1999"
+    std::vector<std::pair<uint32, uint32>> ParseAccountIdList(std::string_view config, std::string_view context, std::vector<std::string>& errors)
+    {
+        std::vector<std::pair<uint32, uint32>> ranges;
+        for (std::string_view token : Acore::Tokenize(config, ',', false))
+        {
+            std::string trimmed = Acore::String::Trim(std::string(token));
+            if (trimmed.empty())
+                continue;
+
+            std::optional<std::pair<uint32, uint32>> range = ParseIdRange(trimmed);
+            if (!range)
+            {
+                errors.push_back(Acore::StringFormat("ignoring invalid account id token '{}' in '{}'", token, context));
+                continue;
             }
+
+            if (range->first > range->second)
+            {
+                errors.push_back(Acore::StringFormat("ignoring reversed account id range '{}' in '{}'", trimmed, context));
+                continue;
+            }
+
+            ranges.push_back(*range);
+        }
+
+        return ranges;
+    }
+
+    // Drops one whitespace separated token per word of the resolved command name,
+    // so abbreviated input such as "tele stormwind" still yields "stormwind".
+    std::string_view StripCommandPath(std::string_view cmdStr, std::string_view command)
+    {
+        std::size_t words = 1 + std::count(command.begin(), command.end(), ' ');
+        while (words-- > 0)
+        {
+            std::size_t const start = cmdStr.find_first_not_of(" \t");
+            if (start == std::string_view::npos)
+                return {};
+
+            cmdStr.remove_prefix(start);
+
+            std::size_t const end = cmdStr.find_first_of(" \t");
+            if (end == std::string_view::npos)
+                return {};
+
+            cmdStr.remove_prefix(end);
         }
 
-        return overrides;
+        std::size_t const start = cmdStr.find_first_not_of(" \t");
+        if (start == std::string_view::npos)
+            return {};
+
+        return cmdStr.substr(start);
+    }
+
+    // Reads a numeric argument, either plain or from a chat link like |Hitem:6948:...|h
+    std::optional<uint32> ParseArgumentId(std::string_view argument)
+    {
+        std::size_t const linkPos = argument.find("|H");
+        if (linkPos != std::string_view::npos)
+        {
+            std::size_t const colonPos = argument.find(':', linkPos);
+            if (colonPos == std::string_view::npos)
+                return std::nullopt;
+
+            argument = argument.substr(colonPos + 1);
+            argument = argument.substr(0, argument.find_first_of(":|"));
+        }
+
+        return Acore::StringTo<uint32>(argument);
+    }
+
+    bool EqualsIgnoreCase(std::string_view left, std::string_view right)
+    {
+        return std::equal(left.begin(), left.end(), right.begin(), right.end(), [](char a, char b)
+        {
+            return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+        });
     }
 }
 
+GMCommands::~GMCommands()
+{
+    StopConfigWatcher();
+}
+
 GMCommands* GMCommands::instance()
 {
     static GMCommands instance;
@@ -122,22 +245,88 @@ GMCommands* GMCommands::instance()
 
 void GMCommands::Reload()
 {
-    _accounts.clear();
-    _presets.clear();
-    _accountToPreset.clear();
-    _accountConfigurations.clear();
-    _effectiveConfigs.clear();
-    _defaultCommands.clear();
     _commandPermissions.clear();
     _lastCommandByHandler.clear();
 
-    _enabled = sConfigMgr->GetOption<bool>(ENABLE_KEY, true);
-    if (!_enabled)
+    std::string const configDirectory = GetModuleConfigDirectory();
+
+    ConfigValues fileValues;
+    LoadIssues issues;
+    ReadModuleConfigFiles(configDirectory, fileValues, issues.Errors);
+
+    // Startup and .reload config keep going on any problem, so everything is only a warning here
+    std::shared_ptr<Policy> policy = BuildPolicy(fileValues, true, issues);
+    for (std::string const& error : issues.Errors)
+        LOG_WARN("modules.gmcommands", "GmCommands: {}", error);
+
+    for (std::string const& warning : issues.Warnings)
+        LOG_WARN("modules.gmcommands", "GmCommands: {}", warning);
+
+    _policy = std::move(policy);
+
+    // A full reload supersedes anything the watcher queued up before it
     {
-        LOG_INFO("modules.gmcommands", "GmCommands: Module is disabled.");
-        return;
+        std::lock_guard<std::mutex> lock(_pendingPolicyLock);
+        _pendingPolicy.reset();
+        _hasPendingPolicy = false;
     }
 
+    if (GetOptionWithoutLog(WATCH_CONFIG_KEY, false))
+        StartConfigWatcher(configDirectory);
+    else
+        StopConfigWatcher();
+}
+
+std::shared_ptr<GMCommands::Policy> GMCommands::BuildPolicy(ConfigValues const& fileValues, bool useConfigMgr, LoadIssues& issues)
+{
+    auto policy = std::make_shared<Policy>();
+
+    // Values loaded by the core take precedence; the files cover keys the core does not know about
+    auto const getValue = [&fileValues, useConfigMgr](std::string const& key) -> std::optional<std::string>
+    {
+        if (useConfigMgr)
+        {
+            std::string value = GetOptionWithoutLog(key, std::string{});
+            if (!value.empty())
+                return value;
+        }
+
+        auto const it = fileValues.find(key);
+        if (it == fileValues.end())
+            return std::nullopt;
+
+        return it->second;
+    };
+
+    auto const getLevel = [&getValue, &issues](std::string const& key) -> std::optional<AccountTypes>
+    {
+        std::optional<std::string> value = getValue(key);
+        if (!value || value->empty())
+            return std::nullopt;
+
+        std::optional<uint32> level = Acore::StringTo<uint32>(*value);
+        if (!level)
+        {
+            issues.Errors.push_back(Acore::StringFormat("ignoring invalid level '{}' for '{}'", *value, key));
+            return std::nullopt;
+        }
+
+        return NormalizeLevel(*level, key, issues);
+    };
+
+    auto const buildCommandSet = [](std::string_view config)
+    {
+        CommandSet commands;
+        for (std::string_view token : Acore::Tokenize(config, ',', false))
+        {
+            std::string normalized = NormalizeCommand(token);
+            if (!normalized.empty())
+                commands.insert(std::move(normalized));
+        }
+
+        return commands;
+    };
+
     auto const buildCommandListString = [](CommandSet const& commands)
     {
         if (commands.empty())
@@ -157,147 +346,208 @@ void GMCommands::Reload()
         return stream.str();
     };
 
-    // Step 1: Load defaults
-    uint32 defaultLevelRaw = sConfigMgr->GetOption<uint32>(DEFAULT_LEVEL_KEY, SEC_PLAYER);
-    _defaultLevel = NormalizeLevel(defaultLevelRaw, DEFAULT_LEVEL_KEY);
+    auto const getBool = [&getValue, &issues](std::string const& key, bool def)
+    {
+        std::optional<std::string> value = getValue(key);
+        if (!value || value->empty())
+            return def;
 
-    std::string defaultCommandsConfig = sConfigMgr->GetOption<std::string>(DEFAULT_COMMANDS_KEY, "");
-    for (std::string_view token : Acore::Tokenize(defaultCommandsConfig, ',', false))
+        std::optional<bool> result = Acore::StringTo<bool>(*value);
+        if (!result)
+        {
+            issues.Errors.push_back(Acore::StringFormat("ignoring invalid value '{}' for '{}'", *value, key));
+            return def;
+        }
+
+        return *result;
+    };
+
+    policy->Enabled = getBool(ENABLE_KEY, true);
+    if (!policy->Enabled)
     {
-        std::string normalized = NormalizeCommand(token);
-        if (!normalized.empty())
-            _defaultCommands.insert(std::move(normalized));
+        LOG_INFO("modules.gmcommands", "GmCommands: Module is disabled.");
+        return policy;
     }
 
-    LOG_INFO("modules.gmcommands", "GmCommands: default level {} with commands [{}]", _defaultLevel, buildCommandListString(_defaultCommands));
+    policy->LazyResolve = getBool(LAZY_RESOLVE_KEY, false);
 
-    // Step 2: Load presets
-    std::string presetsConfig = sConfigMgr->GetOption<std::string>(PRESETS_KEY, "");
-    if (!presetsConfig.empty())
+    // Step 1: Load defaults
+    policy->Defaults.Level = getLevel(DEFAULT_LEVEL_KEY).value_or(SEC_PLAYER);
+    policy->Defaults.Commands = buildCommandSet(getValue(DEFAULT_COMMANDS_KEY).value_or(""));
+
+    LOG_INFO("modules.gmcommands", "GmCommands: default level {} with commands [{}]", policy->Defaults.Level, buildCommandListString(policy->Defaults.Commands));
+
+    // Step 2: Load presets and their bulk account assignments
+    std::vector<AccountRange> presetRanges;
+    std::string presetsConfig = getValue(PRESETS_KEY).value_or("");
+    for (std::string_view presetName : Acore::Tokenize(presetsConfig, ',', false))
     {
-        for (std::string_view presetName : Acore::Tokenize(presetsConfig, ',', false))
-        {
-            std::string presetNameStr = NormalizeCommand(presetName);
-            if (presetNameStr.empty())
-                continue;
+        std::string presetNameStr = NormalizeCommand(presetName);
+        if (presetNameStr.empty())
+            continue;
+
+        Preset preset;
+
+        std::string presetLevelKey = Acore::StringFormat("GmCommandsModule.Preset.{}.Level", presetNameStr);
+        preset.Level = getLevel(presetLevelKey).value_or(SEC_PLAYER);
+
+        std::string presetCommandsKey = Acore::StringFormat("GmCommandsModule.Preset.{}.Commands", presetNameStr);
+        preset.Commands = buildCommandSet(getValue(presetCommandsKey).value_or(""));
+
+        std::string presetArgumentsKey = Acore::StringFormat("GmCommandsModule.Preset.{}.Arguments", presetNameStr);
+        std::string presetArgumentsConfig = getValue(presetArgumentsKey).value_or("");
+        if (!presetArgumentsConfig.empty())
+            preset.Arguments = ParseArgumentPolicies(presetArgumentsConfig, presetArgumentsKey, preset.Commands, issues);
+
+        auto const [presetIt, inserted] = policy->Presets.insert_or_assign(presetNameStr, std::move(preset));
+        LOG_INFO("modules.gmcommands", "GmCommands: registered preset '{}' with level {} and commands [{}] ({} argument rules)",
+                 presetNameStr, presetIt->second.Level, buildCommandListString(presetIt->second.Commands), presetIt->second.Arguments.size());
 
-            Preset preset;
+        std::string presetAccountsKey = Acore::StringFormat("GmCommandsModule.Preset.{}.AccountIds", presetNameStr);
+        for (std::pair<uint32, uint32> const& range : ParseAccountIdList(getValue(presetAccountsKey).value_or(""), presetAccountsKey, issues.Errors))
+            presetRanges.push_back({ range.first, range.second, &presetIt->second, presetIt->first });
+    }
+
+    // Step 3: Build the account interval index. Plain account ids go in first, then each
+    // preset's ranges in declaration order, each one replacing whatever it overlaps.
+    std::map<uint32, AccountRange> index;
+    auto const addRange = [&index, &issues](AccountRange const& range)
+    {
+        auto it = index.lower_bound(range.First);
+        if (it != index.begin() && std::prev(it)->second.Last >= range.First)
+            --it;
 
-            std::string presetLevelKey = Acore::StringFormat("GmCommandsModule.Preset.{}.Level", presetNameStr);
-            uint32 presetLevelRaw = sConfigMgr->GetOption<uint32>(presetLevelKey, SEC_PLAYER);
-            preset.Level = NormalizeLevel(presetLevelRaw, presetLevelKey);
+        while (it != index.end() && it->second.First <= range.Last)
+        {
+            AccountRange const existing = it->second;
+            it = index.erase(it);
 
-            std::string presetCommandsKey = Acore::StringFormat("GmCommandsModule.Preset.{}.Commands", presetNameStr);
-            std::string presetCommandsConfig = sConfigMgr->GetOption<std::string>(presetCommandsKey, "");
-            for (std::string_view cmd : Acore::Tokenize(presetCommandsConfig, ',', false))
+            if (!existing.Preset.empty() && existing.Preset != range.Preset)
             {
-                std::string normalized = NormalizeCommand(cmd);
-                if (!normalized.empty())
-                    preset.Commands.insert(std::move(normalized));
+                issues.Warnings.push_back(Acore::StringFormat("account ids {}-{} are assigned to presets '{}' and '{}'; using '{}'",
+                                                     std::max(existing.First, range.First), std::min(existing.Last, range.Last),
+                                                     existing.Preset, range.Preset, range.Preset));
             }
 
-            _presets[presetNameStr] = std::move(preset);
-            LOG_INFO("modules.gmcommands", "GmCommands: registered preset '{}' with level {} and commands [{}]",
-                     presetNameStr, _presets[presetNameStr].Level, buildCommandListString(_presets[presetNameStr].Commands));
+            if (existing.First < range.First)
+                index.emplace(existing.First, AccountRange{ existing.First, range.First - 1, existing.Config, existing.Preset });
+
+            if (existing.Last > range.Last)
+                index.emplace(range.Last + 1, AccountRange{ range.Last + 1, existing.Last, existing.Config, existing.Preset });
         }
+
+        index.emplace(range.First, range);
+    };
+
+    for (std::pair<uint32, uint32> const& range : ParseAccountIdList(getValue(ACCOUNT_IDS_KEY).value_or(""), ACCOUNT_IDS_KEY, issues.Errors))
+        addRange({ range.first, range.second, &policy->Defaults, {} });
+
+    for (AccountRange const& range : presetRanges)
+        addRange(range);
+
+    uint64 managedAccounts = 0;
+    for (auto const& [first, range] : index)
+    {
+        managedAccounts += static_cast<uint64>(range.Last) - range.First + 1;
+
+        AccountRange* previous = policy->AccountRanges.empty() ? nullptr : &policy->AccountRanges.back();
+        if (previous && previous->Config == range.Config && static_cast<uint64>(previous->Last) + 1 == range.First)
+            previous->Last = range.Last;
+        else
+            policy->AccountRanges.push_back(range);
     }
 
-    // Step 3: Read file overrides (includes preset assignments)
-    std::unordered_map<uint32, FileAccountOverrides> const fileOverrides = ReadAccountOverridesFromConfigFiles();
+    for (AccountRange const& range : policy->AccountRanges)
+    {
+        LOG_INFO("modules.gmcommands", "GmCommands: accounts {}-{} resolved from {}", range.First, range.Last,
+                 range.Preset.empty() ? std::string("defaults") : Acore::StringFormat("preset '{}'", range.Preset));
+    }
 
-    // Step 4: Load account list and build configurations
-    std::string accountIds = sConfigMgr->GetOption<std::string>(ACCOUNT_IDS_KEY, "");
-    for (std::string_view token : Acore::Tokenize(accountIds, ',', false))
+    // Step 4: Load per-account overrides. Only keys that are actually present are visited,
+    // so large ranges do not cost a lookup per account.
+    std::string const accountPrefix = "GmCommandsModule.Account.";
+    std::vector<std::string> accountKeys;
+    for (auto const& [key, value] : fileValues)
     {
-        std::string trimmed = NormalizeCommand(token);
-        if (trimmed.empty())
-            continue;
+        if (key.rfind(accountPrefix, 0) == 0)
+            accountKeys.push_back(key);
+    }
 
-        std::optional<uint32> accountIdOpt = Acore::StringTo<uint32>(trimmed);
-        if (!accountIdOpt)
-        {
-            LogInvalidAccountId(token);
-            continue;
-        }
+    if (useConfigMgr)
+    {
+        std::vector<std::string> configKeys = sConfigMgr->GetKeysByString(accountPrefix);
+        accountKeys.insert(accountKeys.end(), configKeys.begin(), configKeys.end());
+    }
 
-        uint32 accountId = *accountIdOpt;
+    std::set<uint32> accountsWithKeys;
+    for (std::string const& key : accountKeys)
+    {
+        std::string_view const suffix = std::string_view(key).substr(accountPrefix.size());
+        if (std::optional<uint32> accountIdOpt = Acore::StringTo<uint32>(suffix.substr(0, suffix.find('.'))))
+            accountsWithKeys.insert(*accountIdOpt);
+    }
 
-        if (!_accounts.insert(accountId).second)
+    std::size_t overriddenAccounts = 0;
+    for (uint32 accountId : accountsWithKeys)
+    {
+        // Overrides only apply to managed accounts
+        if (!FindAccountRange(policy->AccountRanges, accountId))
             continue;
 
         // Check for preset assignment
         std::string presetAssignmentKey = Acore::StringFormat("GmCommandsModule.Account.{}.Preset", accountId);
-        std::string presetName = GetOptionWithoutLog(presetAssignmentKey, std::string{});
-        if (presetName.empty())
-        {
-            if (auto const fileOverrideIt = fileOverrides.find(accountId); fileOverrideIt != fileOverrides.end() && fileOverrideIt->second.Preset)
-                presetName = *fileOverrideIt->second.Preset;
-        }
-
+        std::string presetName = getValue(presetAssignmentKey).value_or("");
         if (!presetName.empty())
         {
             std::string normalizedPresetName = NormalizeCommand(presetName);
-            if (_presets.find(normalizedPresetName) != _presets.end())
-            {
-                // Check for duplicate preset assignment
-                if (_accountToPreset.find(accountId) != _accountToPreset.end())
-                {
-                    LOG_WARN("modules.gmcommands", "GmCommands: account {} has multiple preset assignments; using last assignment '{}'",
-                             accountId, normalizedPresetName);
-                }
-                _accountToPreset[accountId] = normalizedPresetName;
-            }
+            if (policy->Presets.find(normalizedPresetName) != policy->Presets.end())
+                policy->AccountToPreset[accountId] = normalizedPresetName;
             else
-            {
-                LOG_WARN("modules.gmcommands", "GmCommands: account {} assigned unknown preset '{}'; ignoring assignment",
-                         accountId, normalizedPresetName);
-            }
+                issues.Errors.push_back(Acore::StringFormat("account {} assigned unknown preset '{}'; ignoring assignment", accountId, normalizedPresetName));
         }
 
-        // Load per-account overrides
         AccountConfiguration config;
 
-        std::string levelKey = Acore::StringFormat("GmCommandsModule.Account.{}.Level", accountId);
-        uint32 levelSentinel = std::numeric_limits<uint32>::max();
-        uint32 levelValue = GetOptionWithoutLog(levelKey, levelSentinel);
-        if (levelValue != levelSentinel)
-            config.Level = NormalizeLevel(levelValue, levelKey);
-        else if (auto const fileOverrideIt = fileOverrides.find(accountId); fileOverrideIt != fileOverrides.end() && fileOverrideIt->second.Level)
-            config.Level = NormalizeLevel(*fileOverrideIt->second.Level, levelKey);
+        config.Level = getLevel(Acore::StringFormat("GmCommandsModule.Account.{}.Level", accountId));
 
         std::string commandsKey = Acore::StringFormat("GmCommandsModule.Account.{}.Commands", accountId);
-        std::string commandList = GetOptionWithoutLog(commandsKey, std::string{});
-        if (commandList.empty())
-        {
-            if (auto const fileOverrideIt = fileOverrides.find(accountId); fileOverrideIt != fileOverrides.end() && fileOverrideIt->second.Commands)
-                commandList = *fileOverrideIt->second.Commands;
-        }
-
-        if (!commandList.empty())
-        {
-            CommandSet customCommands;
-            for (std::string_view cmd : Acore::Tokenize(commandList, ',', false))
-            {
-                std::string normalized = NormalizeCommand(cmd);
-                if (!normalized.empty())
-                    customCommands.insert(std::move(normalized));
-            }
-
-            if (!customCommands.empty())
-                config.Commands = std::move(customCommands);
-        }
+        CommandSet customCommands = buildCommandSet(getValue(commandsKey).value_or(""));
+        if (!customCommands.empty())
+            config.Commands = std::move(customCommands);
 
         if (config.Level || config.Commands)
-            _accountConfigurations[accountId] = std::move(config);
+            policy->AccountConfigurations[accountId] = std::move(config);
+
+        if (policy->AccountToPreset.count(accountId) || policy->AccountConfigurations.count(accountId))
+            ++overriddenAccounts;
     }
 
-    // Step 5: Build effective configurations
-    BuildEffectiveConfigs();
+    // Step 5: Build effective configurations for overridden accounts, unless they are
+    // resolved on first use instead
+    if (!policy->LazyResolve)
+        BuildEffectiveConfigs(*policy);
+
+    LOG_INFO("modules.gmcommands", "GmCommands: managing {} accounts in {} ranges ({} with overrides{}) with {} presets",
+             managedAccounts, policy->AccountRanges.size(), overriddenAccounts, policy->LazyResolve ? ", resolved on first use" : "",
+             policy->Presets.size());
 
-    LOG_INFO("modules.gmcommands", "GmCommands: managing {} accounts with {} presets", _accounts.size(), _presets.size());
+    return policy;
 }
 
-void GMCommands::BuildEffectiveConfigs()
+void GMCommands::BuildEffectiveConfigs(Policy& policy)
+{
+    std::set<uint32> accounts;
+    for (auto const& [accountId, presetName] : policy.AccountToPreset)
+        accounts.insert(accountId);
+
+    for (auto const& [accountId, config] : policy.AccountConfigurations)
+        accounts.insert(accountId);
+
+    for (uint32 accountId : accounts)
+        policy.EffectiveConfigs[accountId] = ResolveAccountConfig(policy, accountId);
+}
+
+GMCommands::EffectiveAccountConfig GMCommands::ResolveAccountConfig(Policy const& policy, uint32 accountId)
 {
     auto const buildCommandListString = [](CommandSet const& commands)
     {
@@ -318,78 +568,277 @@ void GMCommands::BuildEffectiveConfigs()
         return stream.str();
     };
 
-    for (uint32 accountId : _accounts)
+    // Start with whatever the account's range resolves to (defaults or a bulk-assigned preset)
+    AccountRange const* range = FindAccountRange(policy.AccountRanges, accountId);
+    EffectiveAccountConfig effective = *range->Config;
+    std::string source = range->Preset.empty() ? std::string("defaults") : Acore::StringFormat("preset '{}'", range->Preset);
+
+    // Apply preset if assigned
+    auto presetIt = policy.AccountToPreset.find(accountId);
+    if (presetIt != policy.AccountToPreset.end())
+    {
+        effective = policy.Presets.at(presetIt->second);
+        source = Acore::StringFormat("preset '{}'", presetIt->second);
+    }
+
+    // Apply per-account overrides
+    auto configIt = policy.AccountConfigurations.find(accountId);
+    if (configIt != policy.AccountConfigurations.end())
+    {
+        if (configIt->second.Level)
+            effective.Level = *configIt->second.Level;
+        if (configIt->second.Commands)
+            effective.Commands = *configIt->second.Commands;
+
+        source = range->Preset.empty() && presetIt == policy.AccountToPreset.end() ? std::string("overrides") : source + " + overrides";
+    }
+
+    LOG_INFO("modules.gmcommands", "GmCommands: account {} resolved from {} -> level {} commands [{}]",
+             accountId, source, effective.Level, buildCommandListString(effective.Commands));
+
+    return effective;
+}
+
+GMCommands::EffectiveAccountConfig const* GMCommands::ResolveAccountConfigLazily(Policy const& policy, uint32 accountId)
+{
     {
-        EffectiveAccountConfig effective;
+        std::shared_lock<std::shared_mutex> lock(policy.ResolvedConfigsLock);
+        auto const it = policy.ResolvedConfigs.find(accountId);
+        if (it != policy.ResolvedConfigs.end())
+            return &it->second;
+    }
+
+    // Resolve outside the lock; if another reader got there first its result is kept
+    EffectiveAccountConfig resolved = ResolveAccountConfig(policy, accountId);
+
+    std::unique_lock<std::shared_mutex> lock(policy.ResolvedConfigsLock);
+    return &policy.ResolvedConfigs.emplace(accountId, std::move(resolved)).first->second;
+}
+
+GMCommands::AccountRange const* GMCommands::FindAccountRange(std::vector<AccountRange> const& ranges, uint32 accountId)
+{
+    auto const it = std::upper_bound(ranges.begin(), ranges.end(), accountId,
+        [](uint32 value, AccountRange const& range) { return value < range.First; });
 
-        // Start with defaults
-        effective.Level = _defaultLevel;
-        effective.Commands = _defaultCommands;
+    if (it == ranges.begin() || std::prev(it)->Last < accountId)
+        return nullptr;
 
-        // Apply preset if assigned
-        auto presetIt = _accountToPreset.find(accountId);
-        if (presetIt != _accountToPreset.end())
+    return &*std::prev(it);
+}
+
+void GMCommands::StartConfigWatcher(std::string const& configDirectory)
+{
+    if (_watcherThread.joinable())
+    {
+        // A watcher that stopped on its own (e.g. a poll error) is restarted on the next reload
+        if (_watchedDirectory == configDirectory && _watcherRunning)
+            return;
+
+        StopConfigWatcher();
+    }
+
+#if defined(__linux__)
+    // Set everything up here so failures leave no watcher state behind and the next reload retries
+    int const inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0)
+    {
+        LOG_ERROR("modules.gmcommands", "GmCommands: inotify_init1 failed: {}", std::strerror(errno));
+        return;
+    }
+
+    // Watch the directory rather than the files: most editors save by renaming a new file over the old one
+    if (inotify_add_watch(inotifyFd, configDirectory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+    {
+        LOG_ERROR("modules.gmcommands", "GmCommands: cannot watch '{}': {}", configDirectory, std::strerror(errno));
+        close(inotifyFd);
+        return;
+    }
+
+    // StopConfigWatcher writes to this so the watcher wakes up immediately instead of on its next poll timeout
+    int const wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd < 0)
+    {
+        LOG_ERROR("modules.gmcommands", "GmCommands: eventfd failed: {}", std::strerror(errno));
+        close(inotifyFd);
+        return;
+    }
+
+    _watcherInotifyFd = inotifyFd;
+    _watcherWakeFd = wakeFd;
+    _watchedDirectory = configDirectory;
+    _watcherStopRequested = false;
+    _watcherRunning = true;
+    _watcherThread = std::thread(&GMCommands::WatchConfigFiles, this, configDirectory);
+    LOG_INFO("modules.gmcommands", "GmCommands: watching '{}' for configuration changes", configDirectory);
+#else
+    LOG_WARN("modules.gmcommands", "GmCommands: '{}' is only supported on Linux; use .reload config instead", WATCH_CONFIG_KEY);
+#endif
+}
+
+void GMCommands::StopConfigWatcher()
+{
+    if (!_watcherThread.joinable())
+        return;
+
+    _watcherStopRequested = true;
+#if defined(__linux__)
+    uint64 const wake = 1;
+    if (write(_watcherWakeFd, &wake, sizeof(wake)) < 0)
+        LOG_ERROR("modules.gmcommands", "GmCommands: waking config watcher failed: {}", std::strerror(errno));
+#endif
+
+    _watcherThread.join();
+    _watchedDirectory.clear();
+
+#if defined(__linux__)
+    close(_watcherInotifyFd);
+    close(_watcherWakeFd);
+    _watcherInotifyFd = -1;
+    _watcherWakeFd = -1;
+#endif
+}
+
+void GMCommands::WatchConfigFiles(std::string configDirectory)
+{
+#if defined(__linux__)
+    int const fd = _watcherInotifyFd;
+    alignas(inotify_event) char buffer[4096];
+    bool changed = false;
+
+    while (!_watcherStopRequested)
+    {
+        std::array<pollfd, 2> descriptors = { { { fd, POLLIN, 0 }, { _watcherWakeFd, POLLIN, 0 } } };
+        int const ready = poll(descriptors.data(), descriptors.size(), changed ? CONFIG_WATCH_SETTLE_MS : -1);
+        if (ready < 0)
         {
-            auto const& preset = _presets.at(presetIt->second);
-            effective.Level = preset.Level;
-            effective.Commands = preset.Commands;
+            if (errno == EINTR)
+                continue;
+
+            LOG_ERROR("modules.gmcommands", "GmCommands: polling config watcher failed: {}", std::strerror(errno));
+            break;
         }
 
-        // Apply per-account overrides
-        auto configIt = _accountConfigurations.find(accountId);
-        if (configIt != _accountConfigurations.end())
+        if (ready == 0)
         {
-            if (configIt->second.Level)
-                effective.Level = *configIt->second.Level;
-            if (configIt->second.Commands)
-                effective.Commands = *configIt->second.Commands;
+            if (changed)
+            {
+                changed = false;
+                ReloadFromConfigFiles(configDirectory);
+            }
+
+            continue;
         }
 
-        _effectiveConfigs[accountId] = effective;
+        if (descriptors[1].revents)
+            break;
 
-        // Log the resolved configuration
-        std::string source = "defaults";
-        if (presetIt != _accountToPreset.end())
+        bool watchRemoved = false;
+        ssize_t length;
+        while ((length = read(fd, buffer, sizeof(buffer))) > 0)
         {
-            source = Acore::StringFormat("preset '{}'", presetIt->second);
-            if (configIt != _accountConfigurations.end() && (configIt->second.Level || configIt->second.Commands))
-                source += " + overrides";
+            for (char const* ptr = buffer; ptr < buffer + length;)
+            {
+                inotify_event const* event = reinterpret_cast<inotify_event const*>(ptr);
+                if (event->mask & IN_IGNORED)
+                    watchRemoved = true;
+                else if (event->mask & IN_Q_OVERFLOW)
+                {
+                    // Events were dropped, so one of them may have been an edit; re-read the files to be safe
+                    LOG_WARN("modules.gmcommands", "GmCommands: inotify event queue overflowed; reloading '{}'", configDirectory);
+                    changed = true;
+                }
+                else if (event->len && (std::strcmp(event->name, MODULE_CONFIG_FILE) == 0 || std::strcmp(event->name, MODULE_CONFIG_DIST_FILE) == 0))
+                    changed = true;
+
+                ptr += sizeof(inotify_event) + event->len;
+            }
         }
-        else if (configIt != _accountConfigurations.end() && (configIt->second.Level || configIt->second.Commands))
+
+        if (watchRemoved)
         {
-            source = "overrides";
+            LOG_ERROR("modules.gmcommands", "GmCommands: '{}' is no longer watched; the watcher restarts on the next reload", configDirectory);
+            break;
         }
+    }
+
+    _watcherRunning = false;
+#else
+    (void)configDirectory;
+#endif
+}
+
+void GMCommands::ReloadFromConfigFiles(std::string const& configDirectory)
+{
+    ConfigValues fileValues;
+    LoadIssues issues;
+    std::shared_ptr<Policy> policy;
+
+    if (!ReadModuleConfigFiles(configDirectory, fileValues, issues.Errors))
+        issues.Errors.push_back(Acore::StringFormat("no module configuration file found in '{}'", configDirectory));
+
+    if (issues.Errors.empty())
+        policy = BuildPolicy(fileValues, false, issues);
+
+    // Warnings are accepted exactly like at startup; only errors reject the edit
+    for (std::string const& warning : issues.Warnings)
+        LOG_WARN("modules.gmcommands", "GmCommands: {}", warning);
+
+    if (!issues.Errors.empty())
+    {
+        for (std::string const& error : issues.Errors)
+            LOG_ERROR("modules.gmcommands", "GmCommands: {}", error);
+
+        LOG_ERROR("modules.gmcommands", "GmCommands: rejected edited configuration with {} errors; keeping the current policy", issues.Errors.size());
+        return;
+    }
 
-        LOG_INFO("modules.gmcommands", "GmCommands: account {} resolved from {} -> level {} commands [{}]",
-                 accountId, source, effective.Level, buildCommandListString(effective.Commands));
+    std::lock_guard<std::mutex> lock(_pendingPolicyLock);
+    _pendingPolicy = std::move(policy);
+    _hasPendingPolicy = true;
+}
+
+void GMCommands::ApplyPendingReload()
+{
+    if (!_hasPendingPolicy)
+        return;
+
+    std::shared_ptr<Policy const> policy;
+    {
+        std::lock_guard<std::mutex> lock(_pendingPolicyLock);
+        policy = std::move(_pendingPolicy);
+        _hasPendingPolicy = false;
     }
+
+    if (!policy)
+        return;
+
+    _policy = std::move(policy);
+    LOG_INFO("modules.gmcommands", "GmCommands: applied edited module configuration");
 }
 
 bool GMCommands::IsEnabled() const
 {
-    return _enabled;
+    return _policy->Enabled;
 }
 
 bool GMCommands::IsAccountAllowed(uint32 accountId) const
 {
-    return _accounts.find(accountId) != _accounts.end();
+    return FindAccountConfig(accountId) != nullptr;
 }
 
 AccountTypes GMCommands::GetAccountLevel(uint32 accountId) const
 {
-    if (!IsAccountAllowed(accountId))
+    EffectiveAccountConfig const* config = FindAccountConfig(accountId);
+    if (!config)
         return SEC_PLAYER;
 
-    auto const it = _effectiveConfigs.find(accountId);
-    if (it != _effectiveConfigs.end())
-        return it->second.Level;
-
-    return _defaultLevel;
+    return config->Level;
 }
 
 bool GMCommands::IsCommandAllowed(uint32 accountId, std::string_view command) const
 {
-    if (!IsAccountAllowed(accountId))
+    EffectiveAccountConfig const* config = FindAccountConfig(accountId);
+    if (!config)
         return false;
 
     std::string normalized = NormalizeCommand(command);
@@ -401,8 +850,39 @@ bool GMCommands::IsCommandAllowed(uint32 accountId, std::string_view command) co
     if (permissionIt != _commandPermissions.end() && permissionIt->second <= SEC_PLAYER)
         return true;
 
-    CommandSet const& commands = GetCommandSetForAccount(accountId);
-    return commands.find(normalized) != commands.end();
+    return config->Commands.find(normalized) != config->Commands.end();
+}
+
+GMCommands::CommandCheckResult GMCommands::CheckCommandExecution(uint32 accountId, ChatHandler const* handler, std::string_view cmdStr, Player const* player) const
+{
+    // Resolve the account once; everything below runs on every command a managed account executes
+    EffectiveAccountConfig const* config = FindAccountConfig(accountId);
+    if (!config)
+        return CommandCheckResult::Allowed;
+
+    // Stored normalized by RememberHandlerCommand, so it can be used as a key as-is
+    auto const handlerIt = _lastCommandByHandler.find(handler);
+    if (handlerIt == _lastCommandByHandler.end())
+        return CommandCheckResult::Allowed;
+
+    std::string const& command = handlerIt->second;
+
+    // Commands that require SEC_PLAYER (0) are always allowed
+    auto const permissionIt = _commandPermissions.find(command);
+    if (permissionIt != _commandPermissions.end() && permissionIt->second <= SEC_PLAYER)
+        return CommandCheckResult::Allowed;
+
+    if (config->Commands.find(command) == config->Commands.end())
+        return CommandCheckResult::CommandDenied;
+
+    auto const policyIt = config->Arguments.find(command);
+    if (policyIt == config->Arguments.end())
+        return CommandCheckResult::Allowed;
+
+    if (!MatchesArgumentPolicy(policyIt->second, StripCommandPath(cmdStr, command), player))
+        return CommandCheckResult::ArgumentsDenied;
+
+    return CommandCheckResult::Allowed;
 }
 
 void GMCommands::RememberCommandMetadata(std::string_view command, uint32 requiredLevel)
@@ -451,13 +931,22 @@ std::optional<uint32> GMCommands::GetCommandRequiredLevel(std::string_view comma
     return it->second;
 }
 
-GMCommands::CommandSet const& GMCommands::GetCommandSetForAccount(uint32 accountId) const
+GMCommands::EffectiveAccountConfig const* GMCommands::FindAccountConfig(uint32 accountId) const
 {
-    auto const it = _effectiveConfigs.find(accountId);
-    if (it != _effectiveConfigs.end())
-        return it->second.Commands;
+    Policy const& policy = *_policy;
 
-    return _defaultCommands;
+    auto const it = policy.EffectiveConfigs.find(accountId);
+    if (it != policy.EffectiveConfigs.end())
+        return &it->second;
+
+    AccountRange const* range = FindAccountRange(policy.AccountRanges, accountId);
+    if (!range)
+        return nullptr;
+
+    if (policy.LazyResolve && (policy.AccountToPreset.count(accountId) || policy.AccountConfigurations.count(accountId)))
+        return ResolveAccountConfigLazily(policy, accountId);
+
+    return range->Config;
 }
 
 std::string GMCommands::NormalizeCommand(std::string_view command)
@@ -496,20 +985,157 @@ std::string GMCommands::NormalizeCommand(std::string_view command)
     return normalized;
 }
 
-AccountTypes GMCommands::NormalizeLevel(uint32 level, std::string_view context)
+AccountTypes GMCommands::NormalizeLevel(uint32 level, std::string_view context, LoadIssues& issues)
 {
     if (level > SEC_ADMINISTRATOR)
     {
-        LOG_WARN("modules.gmcommands", "GmCommands: clamping configured level '{}' for '{}' to SEC_ADMINISTRATOR ({}).", level, context, SEC_ADMINISTRATOR);
+        issues.Warnings.push_back(Acore::StringFormat("clamping configured level '{}' for '{}' to SEC_ADMINISTRATOR ({}).", level, context, SEC_ADMINISTRATOR));
         level = SEC_ADMINISTRATOR;
     }
 
     return static_cast<AccountTypes>(level);
 }
 
-void GMCommands::LogInvalidAccountId(std::string_view token)
+GMCommands::ArgumentPolicyMap GMCommands::ParseArgumentPolicies(std::string_view config, std::string_view context, CommandSet const& commands, LoadIssues& issues)
+{
+    ArgumentPolicyMap policies;
+
+    for (std::string_view entry : Acore::Tokenize(config, ';', false))
+    {
+        // A trailing or doubled ';' leaves a blank entry behind
+        if (entry.find_first_not_of(" \t\r\n") == std::string_view::npos)
+            continue;
+
+        std::size_t const colonPos = entry.find(':');
+        std::string command = NormalizeCommand(entry.substr(0, colonPos));
+        if (colonPos == std::string_view::npos || command.empty())
+        {
+            issues.Errors.push_back(Acore::StringFormat("ignoring malformed argument rule '{}' in '{}'; expected '<command>: <rules>'",
+                                                 NormalizeCommand(entry), context));
+            continue;
+        }
+
+        ArgumentPolicy policy;
+        for (std::string_view token : Acore::Tokenize(entry.substr(colonPos + 1), ',', false))
+        {
+            std::string rule = NormalizeCommand(token);
+            if (rule.empty())
+                continue;
+
+            if (rule == "self")
+            {
+                policy.SelfOnly = true;
+                continue;
+            }
+
+            if (rule == "selfname")
+            {
+                policy.SelfNameOnly = true;
+                continue;
+            }
+
+            if (std::optional<std::pair<uint32, uint32>> range = ParseIdRange(rule))
+            {
+                if (range->first > range->second)
+                {
+                    issues.Errors.push_back(Acore::StringFormat("ignoring reversed id range '{}' for '{}' in '{}'", rule, command, context));
+                    continue;
+                }
+
+                policy.IdRanges.push_back(*range);
+            }
+            else if (LooksLikeIdRange(rule))
+                issues.Errors.push_back(Acore::StringFormat("ignoring invalid id or id range '{}' for '{}' in '{}'", rule, command, context));
+            else
+                policy.Names.push_back(std::move(rule));
+        }
+
+        if (!policy.SelfOnly && !policy.SelfNameOnly && policy.Names.empty() && policy.IdRanges.empty())
+        {
+            issues.Errors.push_back(Acore::StringFormat("ignoring empty argument rule for '{}' in '{}'", command, context));
+            continue;
+        }
+
+        // Sort and merge overlapping or adjacent ranges so lookups are a single binary search
+        std::sort(policy.IdRanges.begin(), policy.IdRanges.end());
+        std::vector<std::pair<uint32, uint32>> merged;
+        for (std::pair<uint32, uint32> const& range : policy.IdRanges)
+        {
+            if (!merged.empty() && static_cast<uint64>(merged.back().second) + 1 >= range.first)
+                merged.back().second = std::max(merged.back().second, range.second);
+            else
+                merged.push_back(range);
+        }
+
+        policy.IdRanges = std::move(merged);
+
+        std::sort(policy.Names.begin(), policy.Names.end());
+        policy.Names.erase(std::unique(policy.Names.begin(), policy.Names.end()), policy.Names.end());
+
+        if (commands.find(command) == commands.end())
+            issues.Warnings.push_back(Acore::StringFormat("argument rule for '{}' in '{}' has no effect because the command is not whitelisted", command, context));
+
+        if (!policies.emplace(command, std::move(policy)).second)
+            issues.Warnings.push_back(Acore::StringFormat("duplicate argument rule for '{}' in '{}'; keeping the first one", command, context));
+    }
+
+    return policies;
+}
+
+bool GMCommands::MatchesArgumentPolicy(ArgumentPolicy const& policy, std::string_view arguments, Player const* player)
 {
-    LOG_WARN("modules.gmcommands", "GmCommands: ignoring invalid account id token '{}'", token);
+    std::string_view const argument = arguments.substr(0, arguments.find_first_of(" \t"));
+
+    if (policy.SelfOnly || policy.SelfNameOnly)
+    {
+        if (!player)
+            return false;
+
+        // Any selection other than the character itself, player or not, is another target.
+        // Without a name argument, selfname commands fall back to the selection, so check it as well
+        ObjectGuid const target = player->GetTarget();
+        bool const checkTarget = policy.SelfOnly || (policy.SelfNameOnly && argument.empty());
+        if (checkTarget && !target.IsEmpty() && target != player->GetGUID())
+            return false;
+
+        if (policy.SelfNameOnly && !argument.empty() && !EqualsIgnoreCase(argument, player->GetName()))
+            return false;
+    }
+
+    if (policy.Names.empty() && policy.IdRanges.empty())
+        return true;
+
+    if (argument.empty())
+        return false;
+
+    if (!policy.Names.empty())
+    {
+        // Names are stored lowercase; compare the argument case-insensitively instead of copying it
+        auto const it = std::lower_bound(policy.Names.begin(), policy.Names.end(), argument, [](std::string_view name, std::string_view value)
+        {
+            return std::lexicographical_compare(name.begin(), name.end(), value.begin(), value.end(), [](char a, char b)
+            {
+                return std::tolower(static_cast<unsigned char>(a)) < std::tolower(static_cast<unsigned char>(b));
+            });
+        });
+
+        if (it != policy.Names.end() && EqualsIgnoreCase(*it, argument))
+            return true;
+    }
+
+    if (!policy.IdRanges.empty())
+    {
+        if (std::optional<uint32> id = ParseArgumentId(argument))
+        {
+            auto const it = std::upper_bound(policy.IdRanges.begin(), policy.IdRanges.end(), *id,
+                [](uint32 value, std::pair<uint32, uint32> const& range) { return value < range.first; });
+
+            if (it != policy.IdRanges.begin() && std::prev(it)->second >= *id)
+                return true;
+        }
+    }
+
+    return false;
 }
 
 class GmCommands : public AllCommandScript
@@ -549,7 +1175,7 @@ public:
         return false;
     }
 
-    bool OnTryExecuteCommand(ChatHandler& handler, std::string_view /*cmdStr*/) override
+    bool OnTryExecuteCommand(ChatHandler& handler, std::string_view cmdStr) override
     {
         if (!sGMCommands->IsEnabled())
             return true;
@@ -561,22 +1187,18 @@ public:
         if (!session)
             return true;
 
-        uint32 accountId = session->GetAccountId();
-        if (!sGMCommands->IsAccountAllowed(accountId))
-            return true;
-
-        std::optional<std::string> commandName = sGMCommands->GetHandlerCommand(&handler);
-        if (!commandName)
-            return true;
-
-        std::optional<uint32> requiredLevel = sGMCommands->GetCommandRequiredLevel(*commandName);
-        if (requiredLevel && *requiredLevel <= SEC_PLAYER)
-            return true;
-
-        if (sGMCommands->IsCommandAllowed(accountId, *commandName))
-            return true;
+        switch (sGMCommands->CheckCommandExecution(session->GetAccountId(), &handler, cmdStr, session->GetPlayer()))
+        {
+            case GMCommands::CommandCheckResult::CommandDenied:
+                handler.SendSysMessage("You are not allowed to use this command.");
+                break;
+            case GMCommands::CommandCheckResult::ArgumentsDenied:
+                handler.SendSysMessage("You are not allowed to use this command with these arguments.");
+                break;
+            default:
+                return true;
+        }
 
-        handler.SendSysMessage("You are not allowed to use this command.");
         handler.SetSentErrorMessage(true);
         return false;
     }
@@ -591,6 +1213,16 @@ public:
     {
         sGMCommands->Reload();
     }
+
+    void OnUpdate(uint32 /*diff*/) override
+    {
+        sGMCommands->ApplyPendingReload();
+    }
+
+    void OnShutdown() override
+    {
+        sGMCommands->StopConfigWatcher();
+    }
 };
 
 class mod_gm_commands_playerscript : public PlayerScript
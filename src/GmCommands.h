@@ -2,25 +2,45 @@
 #define DEF_GMCOMMANDS_H
 
 #include "Common.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 class ChatHandler;
+class Player;
 
 class GMCommands
 {
 public:
+    ~GMCommands();
+
     static GMCommands* instance();
 
     void Reload();
+    void ApplyPendingReload();
+    void StopConfigWatcher();
 
     [[nodiscard]] bool IsEnabled() const;
     [[nodiscard]] bool IsAccountAllowed(uint32 accountId) const;
     [[nodiscard]] AccountTypes GetAccountLevel(uint32 accountId) const;
     [[nodiscard]] bool IsCommandAllowed(uint32 accountId, std::string_view command) const;
 
+    enum class CommandCheckResult
+    {
+        Allowed,
+        CommandDenied,
+        ArgumentsDenied
+    };
+
+    [[nodiscard]] CommandCheckResult CheckCommandExecution(uint32 accountId, ChatHandler const* handler, std::string_view cmdStr, Player const* player) const;
+
     void RememberCommandMetadata(std::string_view command, uint32 requiredLevel);
     void RememberHandlerCommand(ChatHandler const* handler, std::string_view command);
     [[nodiscard]] std::optional<std::string> GetHandlerCommand(ChatHandler const* handler) const;
@@ -28,39 +48,107 @@ public:
 
 private:
     using CommandSet = std::unordered_set<std::string>;
+    using ConfigValues = std::unordered_map<std::string, std::string>;
 
-    struct Preset
+    // Compiled argument constraints for a single command. Names holds sorted
+    // lowercase names and IdRanges sorted, merged ranges, both for binary search.
+    struct ArgumentPolicy
+    {
+        std::vector<std::string> Names;
+        std::vector<std::pair<uint32, uint32>> IdRanges;
+        bool SelfOnly = false;
+        bool SelfNameOnly = false;
+    };
+
+    using ArgumentPolicyMap = std::unordered_map<std::string, ArgumentPolicy>;
+
+    struct EffectiveAccountConfig
     {
         AccountTypes Level = SEC_PLAYER;
         CommandSet Commands;
+        ArgumentPolicyMap Arguments;
     };
 
+    // A preset resolves to exactly what an account assigned to it gets
+    using Preset = EffectiveAccountConfig;
+
     struct AccountConfiguration
     {
         std::optional<AccountTypes> Level;
         std::optional<CommandSet> Commands;
     };
 
-    struct EffectiveAccountConfig
+    // Inclusive range of managed account ids sharing the defaults or one preset
+    struct AccountRange
     {
-        AccountTypes Level = SEC_PLAYER;
-        CommandSet Commands;
+        uint32 First = 0;
+        uint32 Last = 0;
+        EffectiveAccountConfig const* Config = nullptr;
+        std::string_view Preset;
+    };
+
+    // Problems found while loading. Errors make the config watcher reject an
+    // edit; warnings are only logged, as at startup.
+    struct LoadIssues
+    {
+        std::vector<std::string> Errors;
+        std::vector<std::string> Warnings;
     };
 
-    [[nodiscard]] CommandSet const& GetCommandSetForAccount(uint32 accountId) const;
+    // Everything resolved from the module configuration. A policy is built in
+    // full, then swapped in on the world thread and never modified afterwards,
+    // apart from the lazily filled ResolvedConfigs memo.
+    struct Policy
+    {
+        Policy() = default;
+        Policy(Policy const&) = delete;
+        Policy& operator=(Policy const&) = delete;
+
+        bool Enabled = true;
+        bool LazyResolve = false;
+        EffectiveAccountConfig Defaults;
+        std::unordered_map<std::string, Preset> Presets;
+        // Sorted and non-overlapping, pointing into Defaults or Presets
+        std::vector<AccountRange> AccountRanges;
+        // Per-account entries, only for accounts with explicit overrides
+        std::unordered_map<uint32, std::string> AccountToPreset;
+        std::unordered_map<uint32, AccountConfiguration> AccountConfigurations;
+        std::unordered_map<uint32, EffectiveAccountConfig> EffectiveConfigs;
+
+        // Accounts with overrides resolved on first use when LazyResolve is set.
+        // Entries are never erased, so returned pointers stay valid.
+        mutable std::shared_mutex ResolvedConfigsLock;
+        mutable std::unordered_map<uint32, EffectiveAccountConfig> ResolvedConfigs;
+    };
+
+    [[nodiscard]] EffectiveAccountConfig const* FindAccountConfig(uint32 accountId) const;
+    static AccountRange const* FindAccountRange(std::vector<AccountRange> const& ranges, uint32 accountId);
     static std::string NormalizeCommand(std::string_view command);
-    static AccountTypes NormalizeLevel(uint32 level, std::string_view context);
-    static void LogInvalidAccountId(std::string_view token);
-    void BuildEffectiveConfigs();
-
-    AccountTypes _defaultLevel = SEC_PLAYER;
-    CommandSet _defaultCommands;
-    bool _enabled = true;
-    std::unordered_set<uint32> _accounts;
-    std::unordered_map<std::string, Preset> _presets;
-    std::unordered_map<uint32, std::string> _accountToPreset;
-    std::unordered_map<uint32, AccountConfiguration> _accountConfigurations;
-    std::unordered_map<uint32, EffectiveAccountConfig> _effectiveConfigs;
+    static AccountTypes NormalizeLevel(uint32 level, std::string_view context, LoadIssues& issues);
+    static ArgumentPolicyMap ParseArgumentPolicies(std::string_view config, std::string_view context, CommandSet const& commands, LoadIssues& issues);
+    static bool MatchesArgumentPolicy(ArgumentPolicy const& policy, std::string_view arguments, Player const* player);
+    static std::shared_ptr<Policy> BuildPolicy(ConfigValues const& fileValues, bool useConfigMgr, LoadIssues& issues);
+    static void BuildEffectiveConfigs(Policy& policy);
+    static EffectiveAccountConfig ResolveAccountConfig(Policy const& policy, uint32 accountId);
+    static EffectiveAccountConfig const* ResolveAccountConfigLazily(Policy const& policy, uint32 accountId);
+
+    void StartConfigWatcher(std::string const& configDirectory);
+    void WatchConfigFiles(std::string configDirectory);
+    void ReloadFromConfigFiles(std::string const& configDirectory);
+
+    std::shared_ptr<Policy const> _policy = std::make_shared<Policy const>();
+
+    // Written by the config watcher thread, consumed by ApplyPendingReload on the world thread
+    std::mutex _pendingPolicyLock;
+    std::shared_ptr<Policy const> _pendingPolicy;
+    std::atomic<bool> _hasPendingPolicy = false;
+
+    std::thread _watcherThread;
+    std::atomic<bool> _watcherStopRequested = false;
+    std::atomic<bool> _watcherRunning = false;
+    std::string _watchedDirectory;
+    int _watcherInotifyFd = -1;
+    int _watcherWakeFd = -1;
 
     std::unordered_map<std::string, uint32> _commandPermissions;
     mutable std::unordered_map<ChatHandler const*, std::string> _lastCommandByHandler;